@@ -0,0 +1,36 @@
+/*
+ *  Audition - an xUnit Testing Framework for C11 and beyond
+ *  Copyright (c) 2021-2025 Railgun Labs, LLC
+ *
+ *  This library is available under an end-user license agreement (EULA) for
+ *  personal and demo use. For business use or other specific licensing needs,
+ *  a separate licensing agreement must be obtained from Railgun Labs, LLC.
+ *  By using this library, you agree to comply with the terms and conditions
+ *  of the license.
+ *
+ *  For more information on obtaining a personal use or business license,
+ *  please visit <https://RailgunLabs.com/audition/license>.
+ */
+
+// Measures the cost of a passing scalar assertion.
+// The library_call benchmark reproduces the out-of-line call every assertion
+// made before comparisons were inlined; the inline_compare benchmark uses EXPECT_EQ.
+// Run with: your_test_runner.exe --benchmarks assertions.*
+
+#include <audition.h>
+
+static volatile int operand = 42;
+
+BENCHMARK(assertions, library_call) {
+    for (int64_t i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        const int x = operand;
+        audit_expect_eq_sint(x, 42, "x", "42", __FILE__, __LINE__, false, "");
+    }
+}
+
+BENCHMARK(assertions, inline_compare) {
+    for (int64_t i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        const int x = operand;
+        EXPECT_EQ(x, 42);
+    }
+}
@@ -81,6 +81,12 @@
             .iterations = 1,                                                \
             .exit_status = -1,                                              \
             .signal = -1,                                                   \
+            .max_cycles = -1,                                               \
+            .max_instructions = -1,                                         \
+            .max_cache_misses = -1,                                         \
+            .max_branch_misses = -1,                                        \
+            .max_allocs = -1,                                               \
+            .max_alloc_bytes = -1,                                          \
             __VA_ARGS__                                                     \
         },                                                                  \
     };                                                                      \
@@ -102,6 +108,7 @@ extern const int32_t DYNAMIC_ITERATIONS;
 #define FAIL(...) audit_fail(__FILE__, __LINE__, false, __VA_ARGS__)
 
 typedef int64_t StatusCode;
+typedef unsigned long long audit_time;
 
 typedef struct TestOptions
 {
@@ -110,8 +117,108 @@ typedef struct TestOptions
     int64_t signal;
     int timeout;
     bool sandbox;
+    bool serial;
+    bool isolated;
+    int64_t max_cycles;
+    int64_t max_instructions;
+    int64_t max_cache_misses;
+    int64_t max_branch_misses;
+    int64_t max_allocs;
+    int64_t max_alloc_bytes;
+    int32_t warmup;
+    audit_time max_duration_ns;
+    audit_time p95_ns;
+    audit_time p99_ns;
+    bool uncached;
+    bool split_iterations;
+    bool thread_mocks;
 } TestOptions;
 
+typedef struct SuiteOptions
+{
+    bool snapshot;
+} SuiteOptions;
+
+typedef struct BenchmarkOptions
+{
+    int32_t samples;
+    int min_time;
+    int max_time;
+    int64_t bytes;
+    double min_effect;
+} BenchmarkOptions;
+
+#define BENCHMARK(SUITE_NAME, BENCHMARK_NAME, ...)                                      \
+    AUDITION_TEST_WARNINGS_PUSH                                                         \
+    static void SUITE_NAME ## _ ## BENCHMARK_NAME ## _bench_func (int64_t);             \
+    DATA_PUSH                                                                           \
+    const struct xUnitEntryPoint SUITE_NAME ## _ ## BENCHMARK_NAME ## _benchmark = {    \
+        .magic = XUNIT_HEADER_MAGIC,                                                    \
+        .tag = XUNIT_ENTRY_BENCHMARK,                                                   \
+        .c = &audition__libc,                                                           \
+        .u.benchmark.function = SUITE_NAME ## _ ## BENCHMARK_NAME ## _bench_func,       \
+        .u.benchmark.suite = #SUITE_NAME,                                               \
+        .u.benchmark.name = #BENCHMARK_NAME,                                            \
+        .u.benchmark.file = __FILE__,                                                   \
+        .u.benchmark.line = __LINE__,                                                   \
+        .u.benchmark.options = {                                                        \
+            .samples = 20,                                                              \
+            .min_time = 10,                                                             \
+            .max_time = 5000,                                                           \
+            .min_effect = 0.05,                                                         \
+            __VA_ARGS__                                                                 \
+        },                                                                              \
+    };                                                                                  \
+    DATA_POP                                                                            \
+    static void SUITE_NAME ## _ ## BENCHMARK_NAME ## _bench_func (                      \
+        int64_t audition__iterations)                                                   \
+    AUDITION_TEST_WARNINGS_POP
+
+#define BENCHMARK_RESET_TIMER() audit_reset_timer()
+
+#if defined(DOXYGEN)
+extern const int64_t BENCHMARK_ITERATIONS;
+#else
+#define BENCHMARK_ITERATIONS audition__iterations
+#endif
+
+typedef struct FuzzOptions
+{
+    const char *corpus;
+    size_t max_len;
+    int timeout;
+} FuzzOptions;
+
+#define FUZZ(SUITE_NAME, FUZZ_NAME, DATA, SIZE, ...)                                          \
+    AUDITION_TEST_WARNINGS_PUSH                                                               \
+    static void SUITE_NAME ## _ ## FUZZ_NAME ## _fuzz_func (const uint8_t *, size_t);         \
+    DATA_PUSH                                                                                 \
+    const struct xUnitEntryPoint SUITE_NAME ## _ ## FUZZ_NAME ## _fuzz = {                    \
+        .magic = XUNIT_HEADER_MAGIC,                                                          \
+        .tag = XUNIT_ENTRY_FUZZ,                                                              \
+        .c = &audition__libc,                                                                 \
+        .u.fuzz.function = SUITE_NAME ## _ ## FUZZ_NAME ## _fuzz_func,                        \
+        .u.fuzz.suite = #SUITE_NAME,                                                          \
+        .u.fuzz.name = #FUZZ_NAME,                                                            \
+        .u.fuzz.file = __FILE__,                                                              \
+        .u.fuzz.line = __LINE__,                                                              \
+        .u.fuzz.options = {                                                                   \
+            .corpus = "corpus/" #SUITE_NAME "." #FUZZ_NAME,                                   \
+            .max_len = 4096,                                                                  \
+            .timeout = 1000,                                                                  \
+            __VA_ARGS__                                                                       \
+        },                                                                                    \
+    };                                                                                        \
+    DATA_POP                                                                                  \
+    static void SUITE_NAME ## _ ## FUZZ_NAME ## _fuzz_func (const uint8_t *DATA, size_t SIZE) \
+    AUDITION_TEST_WARNINGS_POP
+
+#if defined(__GNUC__) || defined(__clang__)
+#define DO_NOT_OPTIMIZE(X) __asm__ __volatile__("" : : "r,m"(X) : "memory")
+#else
+#define DO_NOT_OPTIMIZE(X) audit_escape(0, (X))
+#endif
+
 #define RUNNER_SETUP()                                                      \
     AUDITION_TEST_WARNINGS_PUSH                                             \
     static void runner_setup_func (void);                                   \
@@ -161,6 +268,27 @@ typedef struct TestOptions
     static void SUITE_NAME ## _beforeAll_func (void)                        \
     AUDITION_TEST_WARNINGS_POP
 
+#define SUITE_SETUP_WITH(SUITE_NAME, ...)                                   \
+    AUDITION_TEST_WARNINGS_PUSH                                             \
+    static void SUITE_NAME ## _beforeAll_func (void);                       \
+    DATA_PUSH                                                               \
+    const struct xUnitEntryPoint SUITE_NAME ## _beforeAll_fixture = {       \
+        .magic = XUNIT_HEADER_MAGIC,                                        \
+        .tag = XUNIT_ENTRY_SUITE_SUITE_SETUP,                               \
+        .c = &audition__libc,                                               \
+        .u.fixture.function = SUITE_NAME ## _beforeAll_func,                \
+        .u.fixture.suite = #SUITE_NAME,                                     \
+        .u.fixture.file = __FILE__,                                         \
+        .u.fixture.line = __LINE__,                                         \
+        .u.fixture.options = {                                              \
+            .snapshot = false,                                              \
+            __VA_ARGS__                                                     \
+        },                                                                  \
+    };                                                                      \
+    DATA_POP                                                                \
+    static void SUITE_NAME ## _beforeAll_func (void)                        \
+    AUDITION_TEST_WARNINGS_POP
+
 #define SUITE_TEARDOWN(SUITE_NAME)                                          \
     AUDITION_TEST_WARNINGS_PUSH                                             \
     static void SUITE_NAME ## _afterAll_func (void);                        \
@@ -270,6 +398,12 @@ typedef struct TestOptions
 #define EXPECT_MEM_EQ(X, Y, SX, SY, ...) audit_expect_eq_mem(X, Y, SX, SY, #X, #Y, __FILE__, __LINE__, false, "" __VA_ARGS__)
 #define EXPECT_MEM_NE(X, Y, SX, SY, ...) audit_expect_ne_mem(X, Y, SX, SY, #X, #Y, __FILE__, __LINE__, false, "" __VA_ARGS__)
 
+#define ASSERT_ARRAY_EQ(X, Y, N, ...) XUNIT_ASSERT_EQ_ARRAY(X, Y, N, #X, #Y, true, "" __VA_ARGS__)
+#define ASSERT_ARRAY_EQ_APPROX(X, Y, N, T, ...) XUNIT_ASSERT_EQ_ARRAY_APPROX(X, Y, N, T, #X, #Y, true, "" __VA_ARGS__)
+
+#define EXPECT_ARRAY_EQ(X, Y, N, ...) XUNIT_ASSERT_EQ_ARRAY(X, Y, N, #X, #Y, false, "" __VA_ARGS__)
+#define EXPECT_ARRAY_EQ_APPROX(X, Y, N, T, ...) XUNIT_ASSERT_EQ_ARRAY_APPROX(X, Y, N, T, #X, #Y, false, "" __VA_ARGS__)
+
 #define FAKE(FUNC, FAKE)                                                            \
     do {                                                                            \
         XUNIT_EXPECT_TYPES_EQUAL(FUNC, FAKE, "function signatures do not match");   \
@@ -313,9 +447,40 @@ typedef struct TestOptions
 #define SUSPEND_MOCKS() audit_suspend_mocks()
 #define RESTORE_MOCKS() audit_restore_mocks()
 
-typedef unsigned long long audit_time;
+#define MOCK_BATCH_BEGIN() audit_mock_batch_begin(__FILE__, __LINE__)
+#define MOCK_BATCH_END() audit_mock_batch_end(__FILE__, __LINE__)
+
+#define CALL_COUNT(FUNC) audit_call_count(FUNC, #FUNC, __FILE__, __LINE__)
+#define RECORD_CALLS(FUNC, DEPTH) audit_record_calls(FUNC, #FUNC, DEPTH, false, __FILE__, __LINE__)
+#define RECORD_TIMED_CALLS(FUNC, DEPTH) audit_record_calls(FUNC, #FUNC, DEPTH, true, __FILE__, __LINE__)
+#define GET_CALL(FUNC, INDEX, CALL) audit_get_call(FUNC, #FUNC, INDEX, CALL, __FILE__, __LINE__)
+
+#define ALLOC_FREE_BEGIN() audit_alloc_free_begin(__FILE__, __LINE__)
+#define ALLOC_FREE_END() audit_alloc_free_end(__FILE__, __LINE__)
+
 typedef void(*audit_listdir_cb)(void *cb_data, const char *filename, bool directory);
 
+typedef struct AllocStats
+{
+    int64_t malloc_calls;
+    int64_t calloc_calls;
+    int64_t realloc_calls;
+    int64_t free_calls;
+    int64_t bytes_allocated;
+    int64_t bytes_live;
+    int64_t peak_rss_bytes;
+} AllocStats;
+
+typedef struct MockCall
+{
+    int64_t index;
+    int32_t nargs;
+    uint64_t args[8];
+    uint64_t result;
+    audit_time timestamp;
+    audit_time duration;
+} MockCall;
+
 XAPI audit_time audit_now(void);
 XAPI void audit_sleep(audit_time duration);
 
@@ -329,6 +494,10 @@ XAPI bool audit_isdir(const char *path);
 XAPI bool audit_isfile(const char *path);
 XAPI int audit_listdir(const char *dir, void *cb_data, audit_listdir_cb cb);
 
+XAPI void audit_escape(int unused, ...);
+
+XAPI void audit_alloc_stats(AllocStats *stats);
+
 XAPI int audit_main(int argc, char *argv[]);
 XAPI bool audit_isboxd(void);
 
@@ -357,6 +526,18 @@ XAPI bool audit_isboxd(void);
 #include <unistd.h>
 #endif
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_memfd_create) && defined(_POSIX_C_SOURCE)
+#define AUDITION__HAVE_MEMFD
+#define AUDITION__MFD_CLOEXEC 0x0001U
+#if !defined(_DEFAULT_SOURCE) && !defined(_GNU_SOURCE) && !defined(_BSD_SOURCE)
+long syscall(long number, ...);
+#endif
+#endif
+
 static FILE *audition__stdany(int fd) {
     switch (fd) {
         case 0: return stdout;
@@ -408,6 +589,40 @@ static int audition__fseek(FILE *stream, long offset, int origin) {
     return fseek(stream, offset, origin);
 }
 
+// Offsets that do not fit the native seek type fail instead of being truncated.
+// Without _POSIX_C_SOURCE the fseeko/ftello declarations are hidden so fall back to fseek/ftell.
+static int audition__fseek64(FILE *stream, int64_t offset, int origin) {
+#if defined(_MSC_VER)
+    return _fseeki64(stream, offset, origin);
+#elif defined(_WIN32)
+    return fseeko64(stream, offset, origin);
+#elif defined(_POSIX_C_SOURCE) && (_POSIX_C_SOURCE >= 200112L)
+    if ((int64_t)(off_t)offset != offset)
+    {
+        return -1;
+    }
+    return fseeko(stream, (off_t)offset, origin);
+#else
+    if ((int64_t)(long)offset != offset)
+    {
+        return -1;
+    }
+    return fseek(stream, (long)offset, origin);
+#endif
+}
+
+static int64_t audition__ftell64(FILE *stream) {
+#if defined(_MSC_VER)
+    return _ftelli64(stream);
+#elif defined(_WIN32)
+    return ftello64(stream);
+#elif defined(_POSIX_C_SOURCE) && (_POSIX_C_SOURCE >= 200112L)
+    return (int64_t)ftello(stream);
+#else
+    return (int64_t)ftell(stream);
+#endif
+}
+
 static size_t audition__fread(void *buffer, size_t size, size_t count, FILE *stream) {
     return fread(buffer, size, count, stream);
 }
@@ -470,6 +685,30 @@ static int audition__dup2(int src, int dst) {
 #endif
 }
 
+// Captured output is written to an anonymous memory file where supported so the
+// runner can map it directly instead of copying it through a temporary file.
+// The memory file is invoked through syscall() so it does not depend on _GNU_SOURCE.
+// The file grows with the output; the runner enforces the capture limit itself.
+static FILE *audition__memfile(void) {
+#if defined(AUDITION__HAVE_MEMFD)
+    const int fd = (int)syscall(SYS_memfd_create, "audition", AUDITION__MFD_CLOEXEC);
+    if (fd < 0)
+    {
+        return audition__tmpfile();
+    }
+
+    FILE *fp = fdopen(fd, "w+b");
+    if (fp == NULL)
+    {
+        close(fd);
+        return audition__tmpfile();
+    }
+    return fp;
+#else
+    return audition__tmpfile();
+#endif
+}
+
 static const struct xUnitLibC
 {
     FILE *(*std)(int fd);
@@ -489,6 +728,9 @@ static const struct xUnitLibC
     int (*fileno)(FILE *stream);
     int (*dup)(int fd);
     int (*dup2)(int src, int dst);
+    FILE *(*memfile)(void);
+    int (*fseek64)(FILE *stream, int64_t offset, int origin);
+    int64_t (*ftell64)(FILE *stream);
 } audition__libc = {
     .std = audition__stdany,
     .tmpfile = audition__tmpfile,
@@ -507,9 +749,14 @@ static const struct xUnitLibC
     .fileno = audition__fileno,
     .dup = audition__dup,
     .dup2 = audition__dup2,
+    .memfile = audition__memfile,
+    .fseek64 = audition__fseek64,
+    .ftell64 = audition__ftell64,
 };
 
 typedef void(*xUnitCallback)(void);
+typedef void(*xUnitBenchmarkCallback)(int64_t iterations);
+typedef void(*xUnitFuzzCallback)(const uint8_t *data, size_t size);
 
 enum xUnitEntryPointTag
 {
@@ -521,6 +768,8 @@ enum xUnitEntryPointTag
     XUNIT_ENTRY_SUITE_TEST_SETUP,
     XUNIT_ENTRY_SUITE_TEST_TEARDOWN,
     XUNIT_ENTRY_TEST,
+    XUNIT_ENTRY_BENCHMARK,
+    XUNIT_ENTRY_FUZZ,
 };
 
 struct xUnitEntryPoint
@@ -546,7 +795,28 @@ struct xUnitEntryPoint
             const char *suite;
             const char *file;
             int line;
+            struct SuiteOptions options;
         } fixture;
+
+        struct
+        {
+            xUnitBenchmarkCallback function;
+            const char *suite;
+            const char *name;
+            const char *file;
+            int line;
+            struct BenchmarkOptions options;
+        } benchmark;
+
+        struct
+        {
+            xUnitFuzzCallback function;
+            const char *suite;
+            const char *name;
+            const char *file;
+            int line;
+            struct FuzzOptions options;
+        } fuzz;
     } u;
 };
 
@@ -671,10 +941,49 @@ XAPI void audit_expect_eq_mem(const void *x_value, const void *y_value, size_t x
 XAPI void audit_expect_ne_mem(const void *x_value, const void *y_value, size_t x_size, size_t y_size,
     const char *x_variable, const char *y_variable, const char *file, int line, bool fail, const char *msg, ...);
 
+XAPI void audit_expect_eq_bool_array(const _Bool *x_val, const _Bool *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_char_array(const char *x_val, const char *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_schar_array(const signed char *x_val, const signed char *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_uchar_array(const unsigned char *x_val, const unsigned char *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_sshort_array(const signed short *x_val, const signed short *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_ushort_array(const unsigned short *x_val, const unsigned short *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_sint_array(const signed int *x_val, const signed int *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_uint_array(const unsigned int *x_val, const unsigned int *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_slong_array(const signed long *x_val, const signed long *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_ulong_array(const unsigned long *x_val, const unsigned long *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_slonglong_array(const signed long long *x_val, const signed long long *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_ulonglong_array(const unsigned long long *x_val, const unsigned long long *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_float_array(const float *x_val, const float *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_double_array(const double *x_val, const double *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_longdouble_array(const long double *x_val, const long double *y_val, size_t count,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+
+XAPI void audit_expect_eq_float_array_approx(const float *x_val, const float *y_val, size_t count, float tolerance,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_double_array_approx(const double *x_val, const double *y_val, size_t count, double tolerance,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+XAPI void audit_expect_eq_longdouble_array_approx(const long double *x_val, const long double *y_val, size_t count, long double tolerance,
+    const char *x_var, const char *y_var, const char *file, int line, bool fail, const char *msg, ...);
+
 XAPI void audit_fail(const char *file, int line, bool fail, const char *fmt, ...);
 
 XAPI void audit_set_test_iterations(const char *name, int count, const char *file, int line);
 XAPI int audit_iteration_index(void);
+XAPI void audit_reset_timer(void);
 
 XAPI void audit_fake(const void *src, const void *dst, const char *src_name, const char *dst_name, const char *file, int line);
 XAPI void audit_restore(const void *address, const char *name, const char *file, int line);
@@ -683,6 +992,16 @@ XAPI void audit_reinstate(int id);
 XAPI void audit_suspend_mocks(void);
 XAPI void audit_restore_mocks(void);
 
+XAPI void audit_mock_batch_begin(const char *file, int line);
+XAPI void audit_mock_batch_end(const char *file, int line);
+
+XAPI int64_t audit_call_count(const void *func, const char *name, const char *file, int line);
+XAPI void audit_record_calls(const void *func, const char *name, int depth, bool timed, const char *file, int line);
+XAPI bool audit_get_call(const void *func, const char *name, int64_t index, MockCall *call, const char *file, int line);
+
+XAPI void audit_alloc_free_begin(const char *file, int line);
+XAPI void audit_alloc_free_end(const char *file, int line);
+
 XAPI void audit_stub_bool(const void *src, const char *src_name, _Bool value, const char *value_name, const char *file, int line);
 XAPI void audit_stub_char(const void *src, const char *src_name, signed char value, const char *value_name, const char *file, int line);
 XAPI void audit_stub_uchar(const void *src, const char *src_name, unsigned char value, const char *value_name, const char *file, int line);
@@ -700,6 +1019,79 @@ XAPI void audit_stub_longdouble(const void *src, const char *src_name, long doub
 XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *value, const char *value_name, const char *file, int line);
 
 
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define XUNIT_THREAD_LOCAL __declspec(thread)
+#else
+    #define XUNIT_THREAD_LOCAL _Thread_local
+#endif
+
+// Scalar assertions compare their operands inline and only call into Audition when the
+// comparison does not hold. The operands are stashed here so the out-of-line function,
+// which decides the final outcome and reports it, never re-evaluates the expressions.
+static XUNIT_THREAD_LOCAL union xUnitOperands
+{
+    _Bool as_bool[2];
+    char as_char[2];
+    signed char as_schar[2];
+    unsigned char as_uchar[2];
+    signed short as_sshort[2];
+    unsigned short as_ushort[2];
+    signed int as_sint[2];
+    unsigned int as_uint[2];
+    signed long as_slong[2];
+    unsigned long as_ulong[2];
+    signed long long as_slonglong[2];
+    unsigned long long as_ulonglong[2];
+    float as_float[2];
+    double as_double[2];
+    long double as_longdouble[2];
+    const void *as_ptr[2];
+} audition__operands;
+
+#define XUNIT_INLINE_COMPARE(NAME, OP, TYPE, SUFFIX)                                \
+    static inline bool audition__## NAME ##_## SUFFIX(TYPE x_val, TYPE y_val) {     \
+        if (x_val OP y_val)                                                         \
+        {                                                                           \
+            return true;                                                            \
+        }                                                                           \
+        audition__operands.as_## SUFFIX[0] = x_val;                                 \
+        audition__operands.as_## SUFFIX[1] = y_val;                                 \
+        return false;                                                               \
+    }
+
+#define XUNIT_INLINE_COMPARE_ALL(TYPE, SUFFIX)                                      \
+    XUNIT_INLINE_COMPARE(eq, ==, TYPE, SUFFIX)                                      \
+    XUNIT_INLINE_COMPARE(ne, !=, TYPE, SUFFIX)                                      \
+    XUNIT_INLINE_COMPARE(lt, <, TYPE, SUFFIX)                                       \
+    XUNIT_INLINE_COMPARE(lteq, <=, TYPE, SUFFIX)                                    \
+    XUNIT_INLINE_COMPARE(gt, >, TYPE, SUFFIX)                                       \
+    XUNIT_INLINE_COMPARE(gteq, >=, TYPE, SUFFIX)
+
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+XUNIT_INLINE_COMPARE(eq, ==, _Bool, bool)
+XUNIT_INLINE_COMPARE(ne, !=, _Bool, bool)
+XUNIT_INLINE_COMPARE_ALL(char, char)
+XUNIT_INLINE_COMPARE_ALL(signed char, schar)
+XUNIT_INLINE_COMPARE_ALL(unsigned char, uchar)
+XUNIT_INLINE_COMPARE_ALL(signed short, sshort)
+XUNIT_INLINE_COMPARE_ALL(unsigned short, ushort)
+XUNIT_INLINE_COMPARE_ALL(signed int, sint)
+XUNIT_INLINE_COMPARE_ALL(unsigned int, uint)
+XUNIT_INLINE_COMPARE_ALL(signed long, slong)
+XUNIT_INLINE_COMPARE_ALL(unsigned long, ulong)
+XUNIT_INLINE_COMPARE_ALL(signed long long, slonglong)
+XUNIT_INLINE_COMPARE_ALL(unsigned long long, ulonglong)
+XUNIT_INLINE_COMPARE_ALL(float, float)
+XUNIT_INLINE_COMPARE_ALL(double, double)
+XUNIT_INLINE_COMPARE_ALL(long double, longdouble)
+XUNIT_INLINE_COMPARE_ALL(const void *, ptr)
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
 // There are multiple bugs with the implementation of _Generic in the Visual Studio C compiler:
 // 
 //   - https://developercommunity.visualstudio.com/t/-generic-char-signed-char-unsigned-char-are-not-di/1228885
@@ -708,7 +1100,136 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
 // Fortunately, some can be worked around. Unfortunately, the workarounds require Audition to define a different
 // set of macros specifically appease for Visual Studio. Note that this workaround is not needed for Clang-CL.
 #if defined(_MSC_VER) && (_MSC_VER < 1944) && !defined(__clang__)
-#define XUNIT_ASSERT_EQ(X, Y, XS, YS, FAIL, ...)             \
+#define XUNIT_OPERAND(X, I)                                      \
+    _Generic((X),                                                \
+        _Bool: audition__operands.as_bool[I],                    \
+        signed char: audition__operands.as_schar[I],             \
+        unsigned char: audition__operands.as_uchar[I],           \
+        signed short: audition__operands.as_sshort[I],           \
+        unsigned short: audition__operands.as_ushort[I],         \
+        signed int: audition__operands.as_sint[I],               \
+        unsigned int: audition__operands.as_uint[I],             \
+        signed long: audition__operands.as_slong[I],             \
+        unsigned long: audition__operands.as_ulong[I],           \
+        signed long long: audition__operands.as_slonglong[I],    \
+        unsigned long long: audition__operands.as_ulonglong[I],  \
+        float: audition__operands.as_float[I],                   \
+        double: audition__operands.as_double[I],                 \
+        long double: audition__operands.as_longdouble[I],        \
+        default: audition__operands.as_ptr[I]                    \
+    )
+
+#define XUNIT_COMPARE_EQ(X, Y)                               \
+    _Generic((X),                                            \
+        _Bool: audition__eq_bool,                            \
+        signed char: audition__eq_schar,                     \
+        unsigned char: audition__eq_uchar,                   \
+        signed short: audition__eq_sshort,                   \
+        unsigned short: audition__eq_ushort,                 \
+        signed int: audition__eq_sint,                       \
+        unsigned int: audition__eq_uint,                     \
+        signed long: audition__eq_slong,                     \
+        unsigned long: audition__eq_ulong,                   \
+        signed long long: audition__eq_slonglong,            \
+        unsigned long long: audition__eq_ulonglong,          \
+        float: audition__eq_float,                           \
+        double: audition__eq_double,                         \
+        long double: audition__eq_longdouble,                \
+        default: audition__eq_ptr                            \
+    )(X,Y)
+
+#define XUNIT_COMPARE_NE(X, Y)                               \
+    _Generic((X),                                            \
+        _Bool: audition__ne_bool,                            \
+        signed char: audition__ne_schar,                     \
+        unsigned char: audition__ne_uchar,                   \
+        signed short: audition__ne_sshort,                   \
+        unsigned short: audition__ne_ushort,                 \
+        signed int: audition__ne_sint,                       \
+        unsigned int: audition__ne_uint,                     \
+        signed long: audition__ne_slong,                     \
+        unsigned long: audition__ne_ulong,                   \
+        signed long long: audition__ne_slonglong,            \
+        unsigned long long: audition__ne_ulonglong,          \
+        float: audition__ne_float,                           \
+        double: audition__ne_double,                         \
+        long double: audition__ne_longdouble,                \
+        default: audition__ne_ptr                            \
+    )(X,Y)
+
+#define XUNIT_COMPARE_LT(X, Y)                               \
+    _Generic((X),                                            \
+        signed char: audition__lt_schar,                     \
+        unsigned char: audition__lt_uchar,                   \
+        signed short: audition__lt_sshort,                   \
+        unsigned short: audition__lt_ushort,                 \
+        signed int: audition__lt_sint,                       \
+        unsigned int: audition__lt_uint,                     \
+        signed long: audition__lt_slong,                     \
+        unsigned long: audition__lt_ulong,                   \
+        signed long long: audition__lt_slonglong,            \
+        unsigned long long: audition__lt_ulonglong,          \
+        float: audition__lt_float,                           \
+        double: audition__lt_double,                         \
+        long double: audition__lt_longdouble,                \
+        default: audition__lt_ptr                            \
+    )(X,Y)
+
+#define XUNIT_COMPARE_LTEQ(X, Y)                             \
+    _Generic((X),                                            \
+        signed char: audition__lteq_schar,                   \
+        unsigned char: audition__lteq_uchar,                 \
+        signed short: audition__lteq_sshort,                 \
+        unsigned short: audition__lteq_ushort,               \
+        signed int: audition__lteq_sint,                     \
+        unsigned int: audition__lteq_uint,                   \
+        signed long: audition__lteq_slong,                   \
+        unsigned long: audition__lteq_ulong,                 \
+        signed long long: audition__lteq_slonglong,          \
+        unsigned long long: audition__lteq_ulonglong,        \
+        float: audition__lteq_float,                         \
+        double: audition__lteq_double,                       \
+        long double: audition__lteq_longdouble,              \
+        default: audition__lteq_ptr                          \
+    )(X,Y)
+
+#define XUNIT_COMPARE_GT(X, Y)                               \
+    _Generic((X),                                            \
+        signed char: audition__gt_schar,                     \
+        unsigned char: audition__gt_uchar,                   \
+        signed short: audition__gt_sshort,                   \
+        unsigned short: audition__gt_ushort,                 \
+        signed int: audition__gt_sint,                       \
+        unsigned int: audition__gt_uint,                     \
+        signed long: audition__gt_slong,                     \
+        unsigned long: audition__gt_ulong,                   \
+        signed long long: audition__gt_slonglong,            \
+        unsigned long long: audition__gt_ulonglong,          \
+        float: audition__gt_float,                           \
+        double: audition__gt_double,                         \
+        long double: audition__gt_longdouble,                \
+        default: audition__gt_ptr                            \
+    )(X,Y)
+
+#define XUNIT_COMPARE_GTEQ(X, Y)                             \
+    _Generic((X),                                            \
+        signed char: audition__gteq_schar,                   \
+        unsigned char: audition__gteq_uchar,                 \
+        signed short: audition__gteq_sshort,                 \
+        unsigned short: audition__gteq_ushort,               \
+        signed int: audition__gteq_sint,                     \
+        unsigned int: audition__gteq_uint,                   \
+        signed long: audition__gteq_slong,                   \
+        unsigned long: audition__gteq_ulong,                 \
+        signed long long: audition__gteq_slonglong,          \
+        unsigned long long: audition__gteq_ulonglong,        \
+        float: audition__gteq_float,                         \
+        double: audition__gteq_double,                       \
+        long double: audition__gteq_longdouble,              \
+        default: audition__gteq_ptr                          \
+    )(X,Y)
+
+#define XUNIT_REPORT_EQ(X, XS, YS, FAIL, ...)                \
     _Generic((X),                                            \
         _Bool: audit_expect_eq_bool,                         \
         signed char: audit_expect_eq_schar,                  \
@@ -725,9 +1246,9 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_eq_double,                      \
         long double: audit_expect_eq_longdouble,             \
         default: audit_expect_eq_ptr                         \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_ASSERT_NE(X, Y, XS, YS, FAIL, ...)             \
+#define XUNIT_REPORT_NE(X, XS, YS, FAIL, ...)                \
     _Generic((X),                                            \
         _Bool: audit_expect_ne_bool,                         \
         signed char: audit_expect_ne_schar,                  \
@@ -744,9 +1265,9 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_ne_double,                      \
         long double: audit_expect_ne_longdouble,             \
         default: audit_expect_ne_ptr                         \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_ASSERT_LT(X, Y, XS, YS, FAIL, ...)             \
+#define XUNIT_REPORT_LT(X, XS, YS, FAIL, ...)                \
     _Generic((X),                                            \
         signed char: audit_expect_lt_schar,                  \
         unsigned char: audit_expect_lt_uchar,                \
@@ -762,9 +1283,9 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_lt_double,                      \
         long double: audit_expect_lt_longdouble,             \
         default: audit_expect_lt_ptr                         \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_ASSERT_LTEQ(X, Y, XS, YS, FAIL, ...)           \
+#define XUNIT_REPORT_LTEQ(X, XS, YS, FAIL, ...)              \
     _Generic((X),                                            \
         signed char: audit_expect_lteq_schar,                \
         unsigned char: audit_expect_lteq_uchar,              \
@@ -780,9 +1301,9 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_lteq_double,                    \
         long double: audit_expect_lteq_longdouble,           \
         default: audit_expect_lteq_ptr                       \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_ASSERT_GT(X, Y, XS, YS, FAIL, ...)             \
+#define XUNIT_REPORT_GT(X, XS, YS, FAIL, ...)                \
     _Generic((X),                                            \
         signed char: audit_expect_gt_schar,                  \
         unsigned char: audit_expect_gt_uchar,                \
@@ -798,9 +1319,9 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_gt_double,                      \
         long double: audit_expect_gt_longdouble,             \
         default: audit_expect_gt_ptr                         \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_ASSERT_GTEQ(X, Y, XS, YS, FAIL, ...)           \
+#define XUNIT_REPORT_GTEQ(X, XS, YS, FAIL, ...)              \
     _Generic((X),                                            \
         signed char: audit_expect_gteq_schar,                \
         unsigned char: audit_expect_gteq_uchar,              \
@@ -816,7 +1337,7 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_gteq_double,                    \
         long double: audit_expect_gteq_longdouble,           \
         default: audit_expect_gteq_ptr                       \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
 #define XUNIT_ASSERT_EQ_STR(X, Y, XS, YS, FAIL, ...)         \
     _Generic((X),                                            \
@@ -895,8 +1416,176 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         const uint_least32_t *: audit_expect_gteq_string32,  \
         default: audit_expect_gteq_wstring                   \
     )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+
+#define XUNIT_ASSERT_EQ_ARRAY(X, Y, N, XS, YS, FAIL, ...)            \
+    _Generic((X),                                                    \
+        _Bool *: audit_expect_eq_bool_array,                         \
+        const _Bool *: audit_expect_eq_bool_array,                   \
+        signed char *: audit_expect_eq_schar_array,                  \
+        const signed char *: audit_expect_eq_schar_array,            \
+        unsigned char *: audit_expect_eq_uchar_array,                \
+        const unsigned char *: audit_expect_eq_uchar_array,          \
+        signed short *: audit_expect_eq_sshort_array,                \
+        const signed short *: audit_expect_eq_sshort_array,          \
+        unsigned short *: audit_expect_eq_ushort_array,              \
+        const unsigned short *: audit_expect_eq_ushort_array,        \
+        signed int *: audit_expect_eq_sint_array,                    \
+        const signed int *: audit_expect_eq_sint_array,              \
+        unsigned int *: audit_expect_eq_uint_array,                  \
+        const unsigned int *: audit_expect_eq_uint_array,            \
+        signed long *: audit_expect_eq_slong_array,                  \
+        const signed long *: audit_expect_eq_slong_array,            \
+        unsigned long *: audit_expect_eq_ulong_array,                \
+        const unsigned long *: audit_expect_eq_ulong_array,          \
+        signed long long *: audit_expect_eq_slonglong_array,         \
+        const signed long long *: audit_expect_eq_slonglong_array,   \
+        unsigned long long *: audit_expect_eq_ulonglong_array,       \
+        const unsigned long long *: audit_expect_eq_ulonglong_array, \
+        float *: audit_expect_eq_float_array,                        \
+        const float *: audit_expect_eq_float_array,                  \
+        double *: audit_expect_eq_double_array,                      \
+        const double *: audit_expect_eq_double_array,                \
+        long double *: audit_expect_eq_longdouble_array,             \
+        const long double *: audit_expect_eq_longdouble_array        \
+    )(X,Y,N,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 #else
-#define XUNIT_ASSERT_EQ(X, Y, XS, YS, FAIL, ...)             \
+#define XUNIT_OPERAND(X, I)                                      \
+    _Generic((X),                                                \
+        _Bool: audition__operands.as_bool[I],                    \
+        char: audition__operands.as_char[I],                     \
+        signed char: audition__operands.as_schar[I],             \
+        unsigned char: audition__operands.as_uchar[I],           \
+        signed short: audition__operands.as_sshort[I],           \
+        unsigned short: audition__operands.as_ushort[I],         \
+        signed int: audition__operands.as_sint[I],               \
+        unsigned int: audition__operands.as_uint[I],             \
+        signed long: audition__operands.as_slong[I],             \
+        unsigned long: audition__operands.as_ulong[I],           \
+        signed long long: audition__operands.as_slonglong[I],    \
+        unsigned long long: audition__operands.as_ulonglong[I],  \
+        float: audition__operands.as_float[I],                   \
+        double: audition__operands.as_double[I],                 \
+        long double: audition__operands.as_longdouble[I],        \
+        default: audition__operands.as_ptr[I]                    \
+    )
+
+#define XUNIT_COMPARE_EQ(X, Y)                               \
+    _Generic((X),                                            \
+        _Bool: audition__eq_bool,                            \
+        char: audition__eq_char,                             \
+        signed char: audition__eq_schar,                     \
+        unsigned char: audition__eq_uchar,                   \
+        signed short: audition__eq_sshort,                   \
+        unsigned short: audition__eq_ushort,                 \
+        signed int: audition__eq_sint,                       \
+        unsigned int: audition__eq_uint,                     \
+        signed long: audition__eq_slong,                     \
+        unsigned long: audition__eq_ulong,                   \
+        signed long long: audition__eq_slonglong,            \
+        unsigned long long: audition__eq_ulonglong,          \
+        float: audition__eq_float,                           \
+        double: audition__eq_double,                         \
+        long double: audition__eq_longdouble,                \
+        default: audition__eq_ptr                            \
+    )(X,Y)
+
+#define XUNIT_COMPARE_NE(X, Y)                               \
+    _Generic((X),                                            \
+        _Bool: audition__ne_bool,                            \
+        char: audition__ne_char,                             \
+        signed char: audition__ne_schar,                     \
+        unsigned char: audition__ne_uchar,                   \
+        signed short: audition__ne_sshort,                   \
+        unsigned short: audition__ne_ushort,                 \
+        signed int: audition__ne_sint,                       \
+        unsigned int: audition__ne_uint,                     \
+        signed long: audition__ne_slong,                     \
+        unsigned long: audition__ne_ulong,                   \
+        signed long long: audition__ne_slonglong,            \
+        unsigned long long: audition__ne_ulonglong,          \
+        float: audition__ne_float,                           \
+        double: audition__ne_double,                         \
+        long double: audition__ne_longdouble,                \
+        default: audition__ne_ptr                            \
+    )(X,Y)
+
+#define XUNIT_COMPARE_LT(X, Y)                               \
+    _Generic((X),                                            \
+        char: audition__lt_char,                             \
+        signed char: audition__lt_schar,                     \
+        unsigned char: audition__lt_uchar,                   \
+        signed short: audition__lt_sshort,                   \
+        unsigned short: audition__lt_ushort,                 \
+        signed int: audition__lt_sint,                       \
+        unsigned int: audition__lt_uint,                     \
+        signed long: audition__lt_slong,                     \
+        unsigned long: audition__lt_ulong,                   \
+        signed long long: audition__lt_slonglong,            \
+        unsigned long long: audition__lt_ulonglong,          \
+        float: audition__lt_float,                           \
+        double: audition__lt_double,                         \
+        long double: audition__lt_longdouble,                \
+        default: audition__lt_ptr                            \
+    )(X,Y)
+
+#define XUNIT_COMPARE_LTEQ(X, Y)                             \
+    _Generic((X),                                            \
+        char: audition__lteq_char,                           \
+        signed char: audition__lteq_schar,                   \
+        unsigned char: audition__lteq_uchar,                 \
+        signed short: audition__lteq_sshort,                 \
+        unsigned short: audition__lteq_ushort,               \
+        signed int: audition__lteq_sint,                     \
+        unsigned int: audition__lteq_uint,                   \
+        signed long: audition__lteq_slong,                   \
+        unsigned long: audition__lteq_ulong,                 \
+        signed long long: audition__lteq_slonglong,          \
+        unsigned long long: audition__lteq_ulonglong,        \
+        float: audition__lteq_float,                         \
+        double: audition__lteq_double,                       \
+        long double: audition__lteq_longdouble,              \
+        default: audition__lteq_ptr                          \
+    )(X,Y)
+
+#define XUNIT_COMPARE_GT(X, Y)                               \
+    _Generic((X),                                            \
+        char: audition__gt_char,                             \
+        signed char: audition__gt_schar,                     \
+        unsigned char: audition__gt_uchar,                   \
+        signed short: audition__gt_sshort,                   \
+        unsigned short: audition__gt_ushort,                 \
+        signed int: audition__gt_sint,                       \
+        unsigned int: audition__gt_uint,                     \
+        signed long: audition__gt_slong,                     \
+        unsigned long: audition__gt_ulong,                   \
+        signed long long: audition__gt_slonglong,            \
+        unsigned long long: audition__gt_ulonglong,          \
+        float: audition__gt_float,                           \
+        double: audition__gt_double,                         \
+        long double: audition__gt_longdouble,                \
+        default: audition__gt_ptr                            \
+    )(X,Y)
+
+#define XUNIT_COMPARE_GTEQ(X, Y)                             \
+    _Generic((X),                                            \
+        char: audition__gteq_char,                           \
+        signed char: audition__gteq_schar,                   \
+        unsigned char: audition__gteq_uchar,                 \
+        signed short: audition__gteq_sshort,                 \
+        unsigned short: audition__gteq_ushort,               \
+        signed int: audition__gteq_sint,                     \
+        unsigned int: audition__gteq_uint,                   \
+        signed long: audition__gteq_slong,                   \
+        unsigned long: audition__gteq_ulong,                 \
+        signed long long: audition__gteq_slonglong,          \
+        unsigned long long: audition__gteq_ulonglong,        \
+        float: audition__gteq_float,                         \
+        double: audition__gteq_double,                       \
+        long double: audition__gteq_longdouble,              \
+        default: audition__gteq_ptr                          \
+    )(X,Y)
+
+#define XUNIT_REPORT_EQ(X, XS, YS, FAIL, ...)                \
     _Generic((X),                                            \
         _Bool: audit_expect_eq_bool,                         \
         char: audit_expect_eq_char,                          \
@@ -914,9 +1603,9 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_eq_double,                      \
         long double: audit_expect_eq_longdouble,             \
         default: audit_expect_eq_ptr                         \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_ASSERT_NE(X, Y, XS, YS, FAIL, ...)             \
+#define XUNIT_REPORT_NE(X, XS, YS, FAIL, ...)                \
     _Generic((X),                                            \
         _Bool: audit_expect_ne_bool,                         \
         char: audit_expect_ne_char,                          \
@@ -934,9 +1623,9 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_ne_double,                      \
         long double: audit_expect_ne_longdouble,             \
         default: audit_expect_ne_ptr                         \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_ASSERT_LT(X, Y, XS, YS, FAIL, ...)             \
+#define XUNIT_REPORT_LT(X, XS, YS, FAIL, ...)                \
     _Generic((X),                                            \
         char: audit_expect_lt_char,                          \
         signed char: audit_expect_lt_schar,                  \
@@ -953,9 +1642,9 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_lt_double,                      \
         long double: audit_expect_lt_longdouble,             \
         default: audit_expect_lt_ptr                         \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_ASSERT_LTEQ(X, Y, XS, YS, FAIL, ...)           \
+#define XUNIT_REPORT_LTEQ(X, XS, YS, FAIL, ...)              \
     _Generic((X),                                            \
         char: audit_expect_lteq_char,                        \
         signed char: audit_expect_lteq_schar,                \
@@ -972,9 +1661,9 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_lteq_double,                    \
         long double: audit_expect_lteq_longdouble,           \
         default: audit_expect_lteq_ptr                       \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_ASSERT_GT(X, Y, XS, YS, FAIL, ...)             \
+#define XUNIT_REPORT_GT(X, XS, YS, FAIL, ...)                \
     _Generic((X),                                            \
         char: audit_expect_gt_char,                          \
         signed char: audit_expect_gt_schar,                  \
@@ -991,9 +1680,9 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_gt_double,                      \
         long double: audit_expect_gt_longdouble,             \
         default: audit_expect_gt_ptr                         \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_ASSERT_GTEQ(X, Y, XS, YS, FAIL, ...)           \
+#define XUNIT_REPORT_GTEQ(X, XS, YS, FAIL, ...)              \
     _Generic((X),                                            \
         char: audit_expect_gteq_char,                        \
         signed char: audit_expect_gteq_schar,                \
@@ -1010,7 +1699,7 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         double: audit_expect_gteq_double,                    \
         long double: audit_expect_gteq_longdouble,           \
         default: audit_expect_gteq_ptr                       \
-    )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+    )(XUNIT_OPERAND(X, 0),XUNIT_OPERAND(X, 1),XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
 #define XUNIT_ASSERT_EQ_STR(X, Y, XS, YS, FAIL, ...)         \
     _Generic((X),                                            \
@@ -1101,8 +1790,60 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         const uint_least32_t *: audit_expect_gteq_string32,  \
         default: audit_expect_gteq_wstring                   \
     )(X,Y,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+
+#define XUNIT_ASSERT_EQ_ARRAY(X, Y, N, XS, YS, FAIL, ...)            \
+    _Generic((X),                                                    \
+        _Bool *: audit_expect_eq_bool_array,                         \
+        const _Bool *: audit_expect_eq_bool_array,                   \
+        char *: audit_expect_eq_char_array,                          \
+        const char *: audit_expect_eq_char_array,                    \
+        signed char *: audit_expect_eq_schar_array,                  \
+        const signed char *: audit_expect_eq_schar_array,            \
+        unsigned char *: audit_expect_eq_uchar_array,                \
+        const unsigned char *: audit_expect_eq_uchar_array,          \
+        signed short *: audit_expect_eq_sshort_array,                \
+        const signed short *: audit_expect_eq_sshort_array,          \
+        unsigned short *: audit_expect_eq_ushort_array,              \
+        const unsigned short *: audit_expect_eq_ushort_array,        \
+        signed int *: audit_expect_eq_sint_array,                    \
+        const signed int *: audit_expect_eq_sint_array,              \
+        unsigned int *: audit_expect_eq_uint_array,                  \
+        const unsigned int *: audit_expect_eq_uint_array,            \
+        signed long *: audit_expect_eq_slong_array,                  \
+        const signed long *: audit_expect_eq_slong_array,            \
+        unsigned long *: audit_expect_eq_ulong_array,                \
+        const unsigned long *: audit_expect_eq_ulong_array,          \
+        signed long long *: audit_expect_eq_slonglong_array,         \
+        const signed long long *: audit_expect_eq_slonglong_array,   \
+        unsigned long long *: audit_expect_eq_ulonglong_array,       \
+        const unsigned long long *: audit_expect_eq_ulonglong_array, \
+        float *: audit_expect_eq_float_array,                        \
+        const float *: audit_expect_eq_float_array,                  \
+        double *: audit_expect_eq_double_array,                      \
+        const double *: audit_expect_eq_double_array,                \
+        long double *: audit_expect_eq_longdouble_array,             \
+        const long double *: audit_expect_eq_longdouble_array        \
+    )(X,Y,N,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 #endif
 
+#define XUNIT_ASSERT_EQ(X, Y, XS, YS, FAIL, ...)             \
+    (XUNIT_COMPARE_EQ(X, Y) ? (void)0 : XUNIT_REPORT_EQ(X, XS, YS, FAIL, __VA_ARGS__))
+
+#define XUNIT_ASSERT_NE(X, Y, XS, YS, FAIL, ...)             \
+    (XUNIT_COMPARE_NE(X, Y) ? (void)0 : XUNIT_REPORT_NE(X, XS, YS, FAIL, __VA_ARGS__))
+
+#define XUNIT_ASSERT_LT(X, Y, XS, YS, FAIL, ...)             \
+    (XUNIT_COMPARE_LT(X, Y) ? (void)0 : XUNIT_REPORT_LT(X, XS, YS, FAIL, __VA_ARGS__))
+
+#define XUNIT_ASSERT_LTEQ(X, Y, XS, YS, FAIL, ...)           \
+    (XUNIT_COMPARE_LTEQ(X, Y) ? (void)0 : XUNIT_REPORT_LTEQ(X, XS, YS, FAIL, __VA_ARGS__))
+
+#define XUNIT_ASSERT_GT(X, Y, XS, YS, FAIL, ...)             \
+    (XUNIT_COMPARE_GT(X, Y) ? (void)0 : XUNIT_REPORT_GT(X, XS, YS, FAIL, __VA_ARGS__))
+
+#define XUNIT_ASSERT_GTEQ(X, Y, XS, YS, FAIL, ...)           \
+    (XUNIT_COMPARE_GTEQ(X, Y) ? (void)0 : XUNIT_REPORT_GTEQ(X, XS, YS, FAIL, __VA_ARGS__))
+
 #define XUNIT_ASSERT_EQ_APPROX(X, Y, T, XS, YS, FAIL, ...)   \
     _Generic((X),                                            \
         float: audit_expect_eq_float_approx,                 \
@@ -1117,6 +1858,17 @@ XAPI void audit_stub_pointer(const void *src, const char *src_name, const void *
         long double: audit_expect_ne_longdouble_approx       \
     )(X,Y,T,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
 
-#define XUNIT_HEADER_MAGIC 0x7E57C0DE4D3FEC75
+#define XUNIT_ASSERT_EQ_ARRAY_APPROX(X, Y, N, T, XS, YS, FAIL, ...)  \
+    _Generic((X),                                                    \
+        float *: audit_expect_eq_float_array_approx,                 \
+        const float *: audit_expect_eq_float_array_approx,           \
+        double *: audit_expect_eq_double_array_approx,               \
+        const double *: audit_expect_eq_double_array_approx,         \
+        long double *: audit_expect_eq_longdouble_array_approx,      \
+        const long double *: audit_expect_eq_longdouble_array_approx \
+    )(X,Y,N,T,XS,YS,__FILE__,__LINE__,FAIL,__VA_ARGS__)
+
+// Must change whenever the layout of xUnitEntryPoint, its options, or xUnitLibC changes.
+#define XUNIT_HEADER_MAGIC 0x7E57C0DE4D3FEC76
 
 #endif